@@ -0,0 +1,44 @@
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// Process-wide memo of solved frontier components, shared by every session.
+// Keys are canonical component encodings produced by minesweeper, so the same
+// local pattern maps to one entry regardless of rotation or reflection.
+class hint_cache final {
+public:
+    struct entry {
+        long long total;
+        // Number of solutions with a mine at each position of the canonical grid
+        std::vector<long long> mine_count;
+    };
+
+    static hint_cache& instance();
+
+    std::shared_ptr<const entry> find(const std::string& key);
+
+    // Returns the stored entry, which is the existing one if another thread won the race
+    std::shared_ptr<const entry> insert(const std::string& key, entry value);
+
+private:
+    static constexpr int SHARD_COUNT = 16;
+    static constexpr std::size_t SHARD_CAPACITY = 256;
+
+    struct shard {
+        std::mutex mutex;
+        // Most recently used key at the front
+        std::list<std::string> lru;
+        std::unordered_map<std::string, std::pair<std::shared_ptr<const entry>, std::list<std::string>::iterator>> entries;
+    };
+
+    shard shards[SHARD_COUNT];
+
+    hint_cache() = default;
+
+    shard& get_shard(const std::string& key);
+};
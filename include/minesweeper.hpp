@@ -7,6 +7,7 @@
 #include <unordered_set>
 #include <chrono>
 #include <functional>
+#include "hint_cache.hpp"
 
 class minesweeper final {
 public:
@@ -33,6 +34,7 @@ private:
     static std::mt19937 generator;
     static constexpr int MAX_RECURSION_DEPTH = 25;
     static constexpr int MAX_DIMENSION = 255;
+    static constexpr std::size_t MAX_CACHED_COMPONENT = 16;
     static constexpr int dx[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
     static constexpr int dy[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
 
@@ -64,6 +66,13 @@ private:
 
     std::vector<std::pair<int, int>> reveal_around(const std::pair<int, int>& cell);
 
+    std::vector<std::vector<std::pair<int, int>>> get_frontier_components() const;
+
+    // Empty string if the component can not be encoded (e.g. too many flags around a number)
+    std::string encode_component(const std::vector<std::pair<int, int>>& component, std::vector<int>& canonical_index) const;
+
+    static hint_cache::entry solve_component(const std::string& key);
+
 public:
 
     minesweeper(const int& _rows, const int& _cols, const double& _density);
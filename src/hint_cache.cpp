@@ -0,0 +1,39 @@
+#include "hint_cache.hpp"
+
+
+hint_cache& hint_cache::instance() {
+    static hint_cache cache;
+    return cache;
+}
+
+hint_cache::shard& hint_cache::get_shard(const std::string& key) {
+    return shards[std::hash<std::string>()(key) % SHARD_COUNT];
+}
+
+std::shared_ptr<const hint_cache::entry> hint_cache::find(const std::string& key) {
+    shard& s = get_shard(key);
+    std::lock_guard<std::mutex> lg(s.mutex);
+    auto it = s.entries.find(key);
+    if (it == s.entries.end())
+        return nullptr;
+    s.lru.splice(s.lru.begin(), s.lru, it->second.second);
+    return it->second.first;
+}
+
+std::shared_ptr<const hint_cache::entry> hint_cache::insert(const std::string& key, entry value) {
+    auto stored = std::make_shared<const entry>(std::move(value));
+    shard& s = get_shard(key);
+    std::lock_guard<std::mutex> lg(s.mutex);
+    if (auto it = s.entries.find(key); it != s.entries.end()) {
+        s.lru.splice(s.lru.begin(), s.lru, it->second.second);
+        return it->second.first;
+    }
+
+    if (s.entries.size() >= SHARD_CAPACITY) {
+        s.entries.erase(s.lru.back());
+        s.lru.pop_back();
+    }
+    s.lru.push_front(key);
+    s.entries.insert({key, {stored, s.lru.begin()}});
+    return stored;
+}
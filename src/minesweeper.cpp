@@ -99,6 +99,161 @@ std::vector<std::pair<int, int>> minesweeper::reveal_around(const std::pair<int,
     return cell_revealed;
 }
 
+std::vector<std::vector<std::pair<int, int>>> minesweeper::get_frontier_components() const {
+    std::unordered_set<std::pair<int, int>, pair_hash> seen;
+    std::vector<std::vector<std::pair<int, int>>> components;
+    for (auto& start : next_to_revealed) {
+        if (revealed[start.first][start.second] || flagged[start.first][start.second] || seen.find(start) != seen.end())
+            continue;
+
+        // Two unrevealed cells are connected if they share a revealed neighbour
+        std::vector<std::pair<int, int>> component{start};
+        seen.insert(start);
+        for (size_t k = 0; k < component.size(); ++k) {
+            for (auto& i : get_revealed_neighbour(component[k])) {
+                for (auto& j : get_unrevealed_neighbour(i)) {
+                    if (seen.insert(j).second)
+                        component.emplace_back(j);
+                }
+            }
+        }
+        components.emplace_back(std::move(component));
+    }
+    return components;
+}
+
+std::string minesweeper::encode_component(const std::vector<std::pair<int, int>>& component, std::vector<int>& canonical_index) const {
+    std::unordered_set<std::pair<int, int>, pair_hash> seen;
+    std::vector<std::pair<int, int>> constraints;
+    for (auto& i : component) {
+        for (auto& j : get_revealed_neighbour(i)) {
+            if (seen.insert(j).second)
+                constraints.emplace_back(j);
+        }
+    }
+
+    int min_x = component[0].first, max_x = min_x, min_y = component[0].second, max_y = min_y;
+    auto extend = [&](const std::pair<int, int>& cell) {
+        min_x = std::min(min_x, cell.first);
+        max_x = std::max(max_x, cell.first);
+        min_y = std::min(min_y, cell.second);
+        max_y = std::max(max_y, cell.second);
+    };
+    std::for_each(component.begin(), component.end(), extend);
+    std::for_each(constraints.begin(), constraints.end(), extend);
+    const int w = max_x - min_x + 1;
+    const int h = max_y - min_y + 1;
+
+    // 'U' for an unrevealed cell of the component, digit for the mines a number still needs.
+    // Every unrevealed neighbour of such a number belongs to the component, so the grid is self-contained.
+    std::string grid(w * h, '.');
+    for (auto& i : constraints) {
+        int needed = get_adjacent_bomb_count(i) - count_adjacent_flag(i);
+        if (needed < 0 || needed > 8)
+            return {};
+        grid[(i.second - min_y) * w + (i.first - min_x)] = '0' + needed;
+    }
+    for (auto& i : component)
+        grid[(i.second - min_y) * w + (i.first - min_x)] = 'U';
+
+    // Bit 0 mirrors x, bit 1 mirrors y, bit 2 swaps the axes: the 8 rotations and reflections
+    auto transform = [&](int x, int y, int t) -> int {
+        if (t & 1) x = w - 1 - x;
+        if (t & 2) y = h - 1 - y;
+        if (t & 4) std::swap(x, y);
+        return y * ((t & 4) ? h : w) + x;
+    };
+
+    std::string best;
+    int best_transform = 0;
+    for (int t = 0; t < 8; ++t) {
+        std::string transformed(w * h, '.');
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x)
+                transformed[transform(x, y, t)] = grid[y * w + x];
+        }
+        std::string key = std::to_string((t & 4) ? h : w) + ':' + transformed;
+        if (t == 0 || key < best) {
+            best = std::move(key);
+            best_transform = t;
+        }
+    }
+
+    canonical_index.clear();
+    for (auto& i : component)
+        canonical_index.emplace_back(transform(i.first - min_x, i.second - min_y, best_transform));
+    return best;
+}
+
+hint_cache::entry minesweeper::solve_component(const std::string& key) {
+    const size_t separator = key.find(':');
+    const int w = std::stoi(key.substr(0, separator));
+    const std::string grid = key.substr(separator + 1);
+    const int h = grid.size() / w;
+
+    std::vector<int> unknown;
+    std::vector<int> unknown_id(grid.size(), -1);
+    for (size_t p = 0; p < grid.size(); ++p) {
+        if (grid[p] == 'U') {
+            unknown_id[p] = unknown.size();
+            unknown.emplace_back(p);
+        }
+    }
+
+    std::vector<int> needed, placed, open;
+    std::vector<std::vector<int>> cell_constraints(unknown.size());
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            if (grid[y * w + x] < '0' || grid[y * w + x] > '8')
+                continue;
+            needed.emplace_back(grid[y * w + x] - '0');
+            placed.emplace_back(0);
+            open.emplace_back(0);
+            for (int i = 0; i < 8; ++i) {
+                int nx = x + dx[i], ny = y + dy[i];
+                if (nx < 0 || nx >= w || ny < 0 || ny >= h || unknown_id[ny * w + nx] < 0)
+                    continue;
+                cell_constraints[unknown_id[ny * w + nx]].emplace_back(needed.size() - 1);
+                open.back()++;
+            }
+        }
+    }
+
+    hint_cache::entry result{0, std::vector<long long>(grid.size(), 0)};
+    std::vector<bool> is_mine(unknown.size(), false);
+
+    std::function<void(size_t)> enumerate;
+
+    enumerate = [&](size_t k) {
+        if (k == unknown.size()) {
+            result.total++;
+            for (size_t i = 0; i < unknown.size(); ++i)
+                result.mine_count[unknown[i]] += is_mine[i];
+            return;
+        }
+
+        for (int mine = 0; mine <= 1; ++mine) {
+            bool feasible = true;
+            for (auto& c : cell_constraints[k]) {
+                open[c]--;
+                placed[c] += mine;
+                feasible &= placed[c] <= needed[c] && placed[c] + open[c] >= needed[c];
+            }
+            if (feasible) {
+                is_mine[k] = mine;
+                enumerate(k + 1);
+            }
+            for (auto& c : cell_constraints[k]) {
+                open[c]++;
+                placed[c] -= mine;
+            }
+        }
+    };
+
+    enumerate(0);
+    return result;
+}
+
 
 minesweeper::minesweeper(const int& _rows, const int& _cols, const double& _density) 
 : rows{_rows}, cols{_cols}, mine_density{_density},
@@ -279,7 +434,7 @@ std::vector<minesweeper::Hint> minesweeper::get_hint() const {
         return ans;
     };
 
-    std::pair<int, int> highest_probability{0, 1};
+    std::pair<long long, long long> highest_probability{0, 1};
     for (auto& i : next_to_revealed) {
         bool trivial_safe = false, trivial_mine = false;
         for (auto& j : get_revealed_neighbour(i)) {
@@ -291,6 +446,39 @@ std::vector<minesweeper::Hint> minesweeper::get_hint() const {
         }
 
     }
+
+    // Small components are enumerated exactly and memoized process-wide by their canonical encoding
+    for (auto& component : get_frontier_components()) {
+        if (component.size() > MAX_CACHED_COMPONENT)
+            continue;
+        std::vector<int> canonical_index;
+        std::string key = encode_component(component, canonical_index);
+        if (key.empty())
+            continue;
+        auto solved = hint_cache::instance().find(key);
+        if (!solved)
+            solved = hint_cache::instance().insert(key, solve_component(key));
+        if (solved->total == 0)
+            continue;
+
+        for (size_t k = 0; k < component.size(); ++k) {
+            auto& [x, y] = component[k];
+            long long mines = solved->mine_count[canonical_index[k]];
+            long long safe = solved->total - mines;
+            vis[component[k]] = true;
+            if (mines == 0) {
+                return {{x, y, HINT_TYPE::SAFE}};
+            } else if (safe == 0) {
+                return {{x, y, HINT_TYPE::MINE}};
+            } else if (safe * highest_probability.second > highest_probability.first * solved->total) {
+                highest_probability = std::make_pair(safe, solved->total);
+                ans = std::vector<minesweeper::Hint>{minesweeper::Hint{x, y, HINT_TYPE::HIGH_PROBABILITY}};
+            } else if (safe * highest_probability.second == highest_probability.first * solved->total) {
+                ans.emplace_back(minesweeper::Hint{x, y, HINT_TYPE::HIGH_PROBABILITY});
+            }
+        }
+    }
+
     for (auto& i : next_to_revealed) {
         if (!vis[i]) {
             dfs(i, 0);